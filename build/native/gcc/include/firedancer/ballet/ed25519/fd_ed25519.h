@@ -0,0 +1,207 @@
+#ifndef HEADER_fd_src_ballet_ed25519_fd_ed25519_h
+#define HEADER_fd_src_ballet_ed25519_fd_ed25519_h
+
+/* fd_ed25519 provides APIs for ED25519 signature computations */
+
+#include "../sha512/fd_sha512.h"
+
+/* FD_ED25519_ERR_* gives a number of error codes used by fd_ed25519
+   APIs. */
+
+#define FD_ED25519_SUCCESS    ( 0) /* Operation was successful */
+#define FD_ED25519_ERR_SIG    (-1) /* Operation failed because the signature was obviously invalid */
+#define FD_ED25519_ERR_PUBKEY (-2) /* Operation failed because the public key was obviously invalid */
+#define FD_ED25519_ERR_MSG    (-3) /* Operation failed because the message didn't match the signature for the given key */
+
+/* FD_ED25519_SIG_SZ: the size of an Ed25519 signature in bytes. */
+#define FD_ED25519_SIG_SZ (64UL)
+
+/* An Ed25519 signature. */
+typedef uchar fd_ed25519_sig_t[ FD_ED25519_SIG_SZ ];
+
+/* FD_ED25519_VERIFY_BATCH_MAX is the max number of signatures accepted
+   by a single fd_ed25519_verify_batch call.
+   FD_ED25519_VERIFY_BATCH_MSG_MAX is the largest message that gets its
+   challenge hash computed in the SHA-512 batch (larger ones are hashed
+   individually).  It covers any message that fits in a txn. */
+
+#define FD_ED25519_VERIFY_BATCH_MAX     (16UL)
+#define FD_ED25519_VERIFY_BATCH_MSG_MAX (1232UL)
+
+/* FD_ED25519_SIGN_BATCH_MAX is the max number of messages signed by a
+   single fd_ed25519_sign_batch call.  FD_ED25519_SIGN_BATCH_MSG_MAX is
+   the largest message that gets its challenge hash computed in the
+   SHA-512 batch (larger ones are hashed individually). */
+
+#define FD_ED25519_SIGN_BATCH_MAX     (32UL)
+#define FD_ED25519_SIGN_BATCH_MSG_MAX (1232UL)
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_ed25519_public_from_private computes the public_key corresponding
+   to the given private key.
+
+   public_key is assumed to point to the first byte of a 32-byte memory
+   region which will hold the public key on return.
+
+   private_key assumed to point to first byte of a 32-byte memory region
+   private key for which the public key is desired.
+
+   sha is a handle of a local join to a sha512 calculator.
+
+   Does no input argument checking.  The caller takes a write interest
+   in public_key and sha and a read interest in public_key for the
+   duration the call.  Sanitizes the sha and stack to minimize risk of
+   leaking private key info before returning.  Returns public_key. */
+
+uchar * FD_FN_SENSITIVE
+fd_ed25519_public_from_private( uchar         public_key [ 32 ],
+                                uchar const   private_key[ 32 ],
+                                fd_sha512_t * sha );
+
+/* fd_ed25519_sign signs a message according to the ED25519 standard.
+
+   sig is assumed to point to the first byte of a 64-byte memory region
+   which will hold the signature on return.
+
+   msg is assumed to point to the first byte of a sz byte memory region
+   which holds the message to sign (sz==0 fine, msg==NULL fine if
+   sz==0).
+
+   public_key is assumed to point to first byte of a 32-byte memory
+   region that holds the public key to use to sign this message.
+
+   private_key is assumed to point to first byte of a 32-byte memory
+   region that holds the private key to use to sign this message.
+
+   sha is a handle of a local join to a sha512 calculator.
+
+   Does no input argument checking.  Sanitizes the sha and stack to
+   minimize risk of leaking private key info after return.  The caller
+   takes a write interest in sig and sha and a read interest in msg,
+   public_key and private_key for the duration the call.  Returns sig. */
+
+uchar * FD_FN_SENSITIVE
+fd_ed25519_sign( uchar         sig[ 64 ],
+                 uchar const   msg[], /* msg_sz */
+                 ulong         msg_sz,
+                 uchar const   public_key[ 32 ],
+                 uchar const   private_key[ 32 ],
+                 fd_sha512_t * sha );
+
+/* fd_ed25519_sign_batch signs batch_sz messages with the same key
+   pair.  msgs[j] and msg_szs[j] describe message j as for
+   fd_ed25519_sign, and sigs[j] points to the 64-byte memory region
+   that will hold its signature on return.  batch_sz is in
+   [0,FD_ED25519_SIGN_BATCH_MAX].
+
+   The signatures are exactly those of calling fd_ed25519_sign on every
+   message.  It is faster because the private key is expanded once per
+   batch, the challenge hashes SHA512(R || A || M) are computed with
+   the batched SHA-512 API, and the points R are encoded with a single
+   shared field inversion.  Each [r]B is still computed in constant
+   time, one message at a time.
+
+   Same interest and sanitization semantics as fd_ed25519_sign. */
+
+void FD_FN_SENSITIVE
+fd_ed25519_sign_batch( uchar * const       sigs[],    /* batch_sz, 64 bytes each */
+                       uchar const * const msgs[],    /* batch_sz */
+                       ulong const         msg_szs[], /* batch_sz */
+                       ulong               batch_sz,
+                       uchar const         public_key[ 32 ],
+                       uchar const         private_key[ 32 ],
+                       fd_sha512_t *       sha );
+
+/* fd_ed25519_verify verifies message according to the ED25519 standard.
+
+   msg is assumed to point to the first byte of a sz byte memory region
+   which holds the message to verify (sz==0 fine, msg==NULL fine if
+   sz==0).
+
+   sig is assumed to point to the first byte of a 64 byte memory region
+   which holds the signature of the message.
+
+   public_key is assumed to point to first byte of a 32-byte memory
+   region that holds the public key to use to verify this message.
+
+   sha is a handle of a local join to a sha512 calculator.
+
+   Does no input argument checking.  This function takes a write
+   interest in sig and sha and a read interest in msg, public_key and
+   private_key for the duration the call.  Sanitizes the sha and stack
+   to minimize risk of leaking private key info after return.  Returns
+   FD_ED25519_SUCCESS (0) if the message verified successfully or a
+   FD_ED25519_ERR_* code indicating the failure reason otherwise. */
+
+int
+fd_ed25519_verify( uchar const   msg[], /* msg_sz */
+                   ulong         msg_sz,
+                   uchar const   sig[ 64 ],
+                   uchar const   public_key[ 32 ],
+                   fd_sha512_t * sha );
+
+/* fd_ed25519_verify_batch_single_msg verifies a batch of signatures
+   over a single message, according to the ED25519 standard.
+
+   msg is assumed to point to the first byte of a msg_sz byte memory region
+   which holds the message to verify (msg_sz==0 fine, msg==NULL fine if
+   msg_sz==0).
+
+   signatures is assumed to point to the first byte of a memory region
+   which holds the signatures of the message. Each signature is 64-byte long.
+
+   pubkeys is assumed to point to first byte of a memory region
+   that holds the public keys to use to verify these signatures.
+   Each public key is 64-byte long.
+
+   shas is an array of handles of a local join to sha512 calculators.
+
+   batch_sz is the size of signatures, pubkeys and shas.
+   batch_sz must be greater than zero.
+
+   See fd_ed25519_verify for more details. */
+
+int
+fd_ed25519_verify_batch_single_msg( uchar const   msg[], /* msg_sz */
+                                    ulong const   msg_sz,
+                                    uchar const   signatures[ 64 ], /* 64 * batch_sz */
+                                    uchar const   pubkeys[ 32 ],    /* 32 * batch_sz */
+                                    fd_sha512_t * shas[ 1 ],               /* batch_sz */
+                                    uchar const   batch_sz );
+
+/* fd_ed25519_verify_batch verifies a batch of batch_sz independent
+   signatures, each over its own message with its own public key.
+
+   msgs[j], msg_szs[j], sigs[j] and pubkeys[j] describe signature j as
+   for fd_ed25519_verify.  sha is a handle of a local join to a sha512
+   calculator.  batch_sz is in [1,FD_ED25519_VERIFY_BATCH_MAX].
+
+   The result is exactly that of calling fd_ed25519_verify on every
+   signature in order and stopping at the first error: returns
+   FD_ED25519_SUCCESS if all signatures verify, else the error code of
+   the lowest indexed failing signature.  It is faster because the
+   per-signature challenge hashes SHA512(R || A || M) are computed with
+   the batched (SIMD across messages) SHA-512 API.  The group equation
+   itself is still checked per signature (no randomized batch check),
+   so the accepted set of signatures is unchanged. */
+
+int
+fd_ed25519_verify_batch( uchar const * const msgs[],    /* batch_sz */
+                         ulong const         msg_szs[], /* batch_sz */
+                         uchar const * const sigs[],    /* batch_sz, 64 bytes each */
+                         uchar const * const pubkeys[], /* batch_sz, 32 bytes each */
+                         fd_sha512_t *       sha,
+                         ulong               batch_sz );
+
+/* fd_ed25519_strerror converts an FD_ED25519_SUCCESS / FD_ED25519_ERR_*
+   code into a human readable cstr.  The lifetime of the returned
+   pointer is infinite.  The returned pointer is always to a non-NULL
+   cstr. */
+
+FD_FN_CONST char const *
+fd_ed25519_strerror( int err );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_ballet_ed25519_fd_ed25519_h */
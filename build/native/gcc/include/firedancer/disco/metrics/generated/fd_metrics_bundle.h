@@ -0,0 +1,94 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_COUNTER_BUNDLE_TRANSACTION_RECEIVED_OFF  (16UL)
+#define FD_METRICS_COUNTER_BUNDLE_TRANSACTION_RECEIVED_NAME "bundle_transaction_received"
+#define FD_METRICS_COUNTER_BUNDLE_TRANSACTION_RECEIVED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_BUNDLE_TRANSACTION_RECEIVED_DESC "Total count of transactions received, including transactions within bundles"
+#define FD_METRICS_COUNTER_BUNDLE_TRANSACTION_RECEIVED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_BUNDLE_PACKET_RECEIVED_OFF  (17UL)
+#define FD_METRICS_COUNTER_BUNDLE_PACKET_RECEIVED_NAME "bundle_packet_received"
+#define FD_METRICS_COUNTER_BUNDLE_PACKET_RECEIVED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_BUNDLE_PACKET_RECEIVED_DESC "Total count of packets received"
+#define FD_METRICS_COUNTER_BUNDLE_PACKET_RECEIVED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_BUNDLE_BUNDLE_RECEIVED_OFF  (18UL)
+#define FD_METRICS_COUNTER_BUNDLE_BUNDLE_RECEIVED_NAME "bundle_bundle_received"
+#define FD_METRICS_COUNTER_BUNDLE_BUNDLE_RECEIVED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_BUNDLE_BUNDLE_RECEIVED_DESC "Total count of bundles received"
+#define FD_METRICS_COUNTER_BUNDLE_BUNDLE_RECEIVED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_OFF  (19UL)
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_NAME "bundle_errors"
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_DESC "Number of gRPC errors encountered"
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_CVT  (FD_METRICS_CONVERTER_NONE)
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_CNT  (5UL)
+
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_PROTOBUF_OFF (19UL)
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_TRANSPORT_OFF (20UL)
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_TIMEOUT_OFF (21UL)
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_NO_FEE_INFO_OFF (22UL)
+#define FD_METRICS_COUNTER_BUNDLE_ERRORS_SSL_ALLOC_OFF (23UL)
+
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_SIZE_OFF  (24UL)
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_SIZE_NAME "bundle_heap_size"
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_SIZE_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_SIZE_DESC "Workspace heap size"
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_SIZE_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_FREE_BYTES_OFF  (25UL)
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_FREE_BYTES_NAME "bundle_heap_free_bytes"
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_FREE_BYTES_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_FREE_BYTES_DESC "Approx free space in workspace"
+#define FD_METRICS_GAUGE_BUNDLE_HEAP_FREE_BYTES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_BUNDLE_SHREDSTREAM_HEARTBEATS_OFF  (26UL)
+#define FD_METRICS_COUNTER_BUNDLE_SHREDSTREAM_HEARTBEATS_NAME "bundle_shredstream_heartbeats"
+#define FD_METRICS_COUNTER_BUNDLE_SHREDSTREAM_HEARTBEATS_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_BUNDLE_SHREDSTREAM_HEARTBEATS_DESC "Number of ShredStream heartbeats successfully sent"
+#define FD_METRICS_COUNTER_BUNDLE_SHREDSTREAM_HEARTBEATS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_BUNDLE_KEEPALIVES_OFF  (27UL)
+#define FD_METRICS_COUNTER_BUNDLE_KEEPALIVES_NAME "bundle_keepalives"
+#define FD_METRICS_COUNTER_BUNDLE_KEEPALIVES_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_BUNDLE_KEEPALIVES_DESC "Number of HTTP/2 PINGs acknowledged by server"
+#define FD_METRICS_COUNTER_BUNDLE_KEEPALIVES_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_BUNDLE_CONNECTED_OFF  (28UL)
+#define FD_METRICS_GAUGE_BUNDLE_CONNECTED_NAME "bundle_connected"
+#define FD_METRICS_GAUGE_BUNDLE_CONNECTED_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_BUNDLE_CONNECTED_DESC "1 if connected to the bundle server, 0 if not"
+#define FD_METRICS_GAUGE_BUNDLE_CONNECTED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SAMPLE_OFF  (29UL)
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SAMPLE_NAME "bundle_rtt_sample"
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SAMPLE_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SAMPLE_DESC "Latest RTT sample at scrape time (nanoseconds)"
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SAMPLE_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SMOOTHED_OFF  (30UL)
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SMOOTHED_NAME "bundle_rtt_smoothed"
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SMOOTHED_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SMOOTHED_DESC "RTT moving average (nanoseconds)"
+#define FD_METRICS_GAUGE_BUNDLE_RTT_SMOOTHED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_BUNDLE_RTT_VAR_OFF  (31UL)
+#define FD_METRICS_GAUGE_BUNDLE_RTT_VAR_NAME "bundle_rtt_var"
+#define FD_METRICS_GAUGE_BUNDLE_RTT_VAR_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_BUNDLE_RTT_VAR_DESC "RTT variance (nanoseconds)"
+#define FD_METRICS_GAUGE_BUNDLE_RTT_VAR_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_HISTOGRAM_BUNDLE_MESSAGE_RX_DELAY_NANOS_OFF  (32UL)
+#define FD_METRICS_HISTOGRAM_BUNDLE_MESSAGE_RX_DELAY_NANOS_NAME "bundle_message_rx_delay_nanos"
+#define FD_METRICS_HISTOGRAM_BUNDLE_MESSAGE_RX_DELAY_NANOS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_BUNDLE_MESSAGE_RX_DELAY_NANOS_DESC "Message receive delay in nanoseconds from bundle server to bundle client"
+#define FD_METRICS_HISTOGRAM_BUNDLE_MESSAGE_RX_DELAY_NANOS_CVT  (FD_METRICS_CONVERTER_NONE)
+#define FD_METRICS_HISTOGRAM_BUNDLE_MESSAGE_RX_DELAY_NANOS_MIN  (100000UL)
+#define FD_METRICS_HISTOGRAM_BUNDLE_MESSAGE_RX_DELAY_NANOS_MAX  (1000000000UL)
+
+#define FD_METRICS_BUNDLE_TOTAL (17UL)
+extern const fd_metrics_meta_t FD_METRICS_BUNDLE[FD_METRICS_BUNDLE_TOTAL];
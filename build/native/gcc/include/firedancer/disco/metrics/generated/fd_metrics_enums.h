@@ -0,0 +1,697 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#define FD_METRICS_ENUM_TILE_REGIME_NAME "tile_regime"
+#define FD_METRICS_ENUM_TILE_REGIME_CNT (8UL)
+#define FD_METRICS_ENUM_TILE_REGIME_V_CAUGHT_UP_HOUSEKEEPING_IDX  0
+#define FD_METRICS_ENUM_TILE_REGIME_V_CAUGHT_UP_HOUSEKEEPING_NAME "caught_up_housekeeping"
+#define FD_METRICS_ENUM_TILE_REGIME_V_PROCESSING_HOUSEKEEPING_IDX  1
+#define FD_METRICS_ENUM_TILE_REGIME_V_PROCESSING_HOUSEKEEPING_NAME "processing_housekeeping"
+#define FD_METRICS_ENUM_TILE_REGIME_V_BACKPRESSURE_HOUSEKEEPING_IDX  2
+#define FD_METRICS_ENUM_TILE_REGIME_V_BACKPRESSURE_HOUSEKEEPING_NAME "backpressure_housekeeping"
+#define FD_METRICS_ENUM_TILE_REGIME_V_CAUGHT_UP_PREFRAG_IDX  3
+#define FD_METRICS_ENUM_TILE_REGIME_V_CAUGHT_UP_PREFRAG_NAME "caught_up_prefrag"
+#define FD_METRICS_ENUM_TILE_REGIME_V_PROCESSING_PREFRAG_IDX  4
+#define FD_METRICS_ENUM_TILE_REGIME_V_PROCESSING_PREFRAG_NAME "processing_prefrag"
+#define FD_METRICS_ENUM_TILE_REGIME_V_BACKPRESSURE_PREFRAG_IDX  5
+#define FD_METRICS_ENUM_TILE_REGIME_V_BACKPRESSURE_PREFRAG_NAME "backpressure_prefrag"
+#define FD_METRICS_ENUM_TILE_REGIME_V_CAUGHT_UP_POSTFRAG_IDX  6
+#define FD_METRICS_ENUM_TILE_REGIME_V_CAUGHT_UP_POSTFRAG_NAME "caught_up_postfrag"
+#define FD_METRICS_ENUM_TILE_REGIME_V_PROCESSING_POSTFRAG_IDX  7
+#define FD_METRICS_ENUM_TILE_REGIME_V_PROCESSING_POSTFRAG_NAME "processing_postfrag"
+
+#define FD_METRICS_ENUM_SOCK_ERR_NAME "sock_err"
+#define FD_METRICS_ENUM_SOCK_ERR_CNT (6UL)
+#define FD_METRICS_ENUM_SOCK_ERR_V_NO_ERROR_IDX  0
+#define FD_METRICS_ENUM_SOCK_ERR_V_NO_ERROR_NAME "no_error"
+#define FD_METRICS_ENUM_SOCK_ERR_V_SLOW_IDX  1
+#define FD_METRICS_ENUM_SOCK_ERR_V_SLOW_NAME "slow"
+#define FD_METRICS_ENUM_SOCK_ERR_V_PERM_IDX  2
+#define FD_METRICS_ENUM_SOCK_ERR_V_PERM_NAME "perm"
+#define FD_METRICS_ENUM_SOCK_ERR_V_UNREACH_IDX  3
+#define FD_METRICS_ENUM_SOCK_ERR_V_UNREACH_NAME "unreach"
+#define FD_METRICS_ENUM_SOCK_ERR_V_DOWN_IDX  4
+#define FD_METRICS_ENUM_SOCK_ERR_V_DOWN_NAME "down"
+#define FD_METRICS_ENUM_SOCK_ERR_V_OTHER_IDX  5
+#define FD_METRICS_ENUM_SOCK_ERR_V_OTHER_NAME "other"
+
+#define FD_METRICS_ENUM_TPU_RECV_TYPE_NAME "tpu_recv_type"
+#define FD_METRICS_ENUM_TPU_RECV_TYPE_CNT (3UL)
+#define FD_METRICS_ENUM_TPU_RECV_TYPE_V_UDP_IDX  0
+#define FD_METRICS_ENUM_TPU_RECV_TYPE_V_UDP_NAME "udp"
+#define FD_METRICS_ENUM_TPU_RECV_TYPE_V_QUIC_FAST_IDX  1
+#define FD_METRICS_ENUM_TPU_RECV_TYPE_V_QUIC_FAST_NAME "quic_fast"
+#define FD_METRICS_ENUM_TPU_RECV_TYPE_V_QUIC_FRAG_IDX  2
+#define FD_METRICS_ENUM_TPU_RECV_TYPE_V_QUIC_FRAG_NAME "quic_frag"
+
+#define FD_METRICS_ENUM_FRAME_TX_ALLOC_RESULT_NAME "frame_tx_alloc_result"
+#define FD_METRICS_ENUM_FRAME_TX_ALLOC_RESULT_CNT (3UL)
+#define FD_METRICS_ENUM_FRAME_TX_ALLOC_RESULT_V_SUCCESS_IDX  0
+#define FD_METRICS_ENUM_FRAME_TX_ALLOC_RESULT_V_SUCCESS_NAME "success"
+#define FD_METRICS_ENUM_FRAME_TX_ALLOC_RESULT_V_FAIL_EMPTY_POOL_IDX  1
+#define FD_METRICS_ENUM_FRAME_TX_ALLOC_RESULT_V_FAIL_EMPTY_POOL_NAME "fail_empty_pool"
+#define FD_METRICS_ENUM_FRAME_TX_ALLOC_RESULT_V_FAIL_CONN_MAX_IDX  2
+#define FD_METRICS_ENUM_FRAME_TX_ALLOC_RESULT_V_FAIL_CONN_MAX_NAME "fail_conn_max"
+
+#define FD_METRICS_ENUM_QUIC_INITIAL_TOKEN_LEN_NAME "quic_initial_token_len"
+#define FD_METRICS_ENUM_QUIC_INITIAL_TOKEN_LEN_CNT (3UL)
+#define FD_METRICS_ENUM_QUIC_INITIAL_TOKEN_LEN_V_ZERO_IDX  0
+#define FD_METRICS_ENUM_QUIC_INITIAL_TOKEN_LEN_V_ZERO_NAME "zero"
+#define FD_METRICS_ENUM_QUIC_INITIAL_TOKEN_LEN_V_FD_QUIC_LEN_IDX  1
+#define FD_METRICS_ENUM_QUIC_INITIAL_TOKEN_LEN_V_FD_QUIC_LEN_NAME "fd_quic_len"
+#define FD_METRICS_ENUM_QUIC_INITIAL_TOKEN_LEN_V_INVALID_LEN_IDX  2
+#define FD_METRICS_ENUM_QUIC_INITIAL_TOKEN_LEN_V_INVALID_LEN_NAME "invalid_len"
+
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_NAME "quic_frame_type"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_CNT (22UL)
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_UNKNOWN_IDX  0
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_UNKNOWN_NAME "unknown"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_ACK_IDX  1
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_ACK_NAME "ack"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_RESET_STREAM_IDX  2
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_RESET_STREAM_NAME "reset_stream"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_STOP_SENDING_IDX  3
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_STOP_SENDING_NAME "stop_sending"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_CRYPTO_IDX  4
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_CRYPTO_NAME "crypto"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_NEW_TOKEN_IDX  5
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_NEW_TOKEN_NAME "new_token"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_STREAM_IDX  6
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_STREAM_NAME "stream"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_MAX_DATA_IDX  7
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_MAX_DATA_NAME "max_data"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_MAX_STREAM_DATA_IDX  8
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_MAX_STREAM_DATA_NAME "max_stream_data"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_MAX_STREAMS_IDX  9
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_MAX_STREAMS_NAME "max_streams"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_DATA_BLOCKED_IDX  10
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_DATA_BLOCKED_NAME "data_blocked"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_STREAM_DATA_BLOCKED_IDX  11
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_STREAM_DATA_BLOCKED_NAME "stream_data_blocked"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_STREAMS_BLOCKED_IDX  12
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_STREAMS_BLOCKED_NAME "streams_blocked"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_NEW_CONN_ID_IDX  13
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_NEW_CONN_ID_NAME "new_conn_id"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_RETIRE_CONN_ID_IDX  14
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_RETIRE_CONN_ID_NAME "retire_conn_id"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_PATH_CHALLENGE_IDX  15
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_PATH_CHALLENGE_NAME "path_challenge"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_PATH_RESPONSE_IDX  16
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_PATH_RESPONSE_NAME "path_response"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_CONN_CLOSE_QUIC_IDX  17
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_CONN_CLOSE_QUIC_NAME "conn_close_quic"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_CONN_CLOSE_APP_IDX  18
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_CONN_CLOSE_APP_NAME "conn_close_app"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_HANDSHAKE_DONE_IDX  19
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_HANDSHAKE_DONE_NAME "handshake_done"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_PING_IDX  20
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_PING_NAME "ping"
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_PADDING_IDX  21
+#define FD_METRICS_ENUM_QUIC_FRAME_TYPE_V_PADDING_NAME "padding"
+
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_NAME "quic_stream_close_type"
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_CNT (5UL)
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_END_IDX  0
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_END_NAME "end"
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_PEER_RESET_IDX  1
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_PEER_RESET_NAME "peer_reset"
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_PEER_STOP_IDX  2
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_PEER_STOP_NAME "peer_stop"
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_DROP_IDX  3
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_DROP_NAME "drop"
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_CONN_ABORT_IDX  4
+#define FD_METRICS_ENUM_QUIC_STREAM_CLOSE_TYPE_V_CONN_ABORT_NAME "conn_abort"
+
+#define FD_METRICS_ENUM_QUIC_ACK_TX_NAME "quic_ack_tx"
+#define FD_METRICS_ENUM_QUIC_ACK_TX_CNT (5UL)
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_NOOP_IDX  0
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_NOOP_NAME "noop"
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_NEW_IDX  1
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_NEW_NAME "new"
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_MERGED_IDX  2
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_MERGED_NAME "merged"
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_DROP_IDX  3
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_DROP_NAME "drop"
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_CANCEL_IDX  4
+#define FD_METRICS_ENUM_QUIC_ACK_TX_V_CANCEL_NAME "cancel"
+
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_NAME "quic_enc_level"
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_CNT (4UL)
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_V_INITIAL_IDX  0
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_V_INITIAL_NAME "initial"
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_V_EARLY_IDX  1
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_V_EARLY_NAME "early"
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_V_HANDSHAKE_IDX  2
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_V_HANDSHAKE_NAME "handshake"
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_V_APP_IDX  3
+#define FD_METRICS_ENUM_QUIC_ENC_LEVEL_V_APP_NAME "app"
+
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_NAME "quic_conn_state"
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_CNT (8UL)
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_INVALID_IDX  0
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_INVALID_NAME "invalid"
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_HANDSHAKE_IDX  1
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_HANDSHAKE_NAME "handshake"
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_HANDSHAKE_COMPLETE_IDX  2
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_HANDSHAKE_COMPLETE_NAME "handshake_complete"
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_ACTIVE_IDX  3
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_ACTIVE_NAME "active"
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_PEER_CLOSE_IDX  4
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_PEER_CLOSE_NAME "peer_close"
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_ABORT_IDX  5
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_ABORT_NAME "abort"
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_CLOSE_PENDING_IDX  6
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_CLOSE_PENDING_NAME "close_pending"
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_DEAD_IDX  7
+#define FD_METRICS_ENUM_QUIC_CONN_STATE_V_DEAD_NAME "dead"
+
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_NAME "new_contact_outcome"
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_CNT (4UL)
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_V_UNROUTABLE_IDX  0
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_V_UNROUTABLE_NAME "unroutable"
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_V_INITIALIZED_IDX  1
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_V_INITIALIZED_NAME "initialized"
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_V_CHANGED_IDX  2
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_V_CHANGED_NAME "changed"
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_V_NO_CHANGE_IDX  3
+#define FD_METRICS_ENUM_NEW_CONTACT_OUTCOME_V_NO_CHANGE_NAME "no_change"
+
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_NAME "txn_send_result"
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_CNT (4UL)
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_V_SUCCESS_IDX  0
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_V_SUCCESS_NAME "success"
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_V_NO_CI_IDX  1
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_V_NO_CI_NAME "no_ci"
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_V_NO_CONN_IDX  2
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_V_NO_CONN_NAME "no_conn"
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_V_NO_STREAM_IDX  3
+#define FD_METRICS_ENUM_TXN_SEND_RESULT_V_NO_STREAM_NAME "no_stream"
+
+#define FD_METRICS_ENUM_SEND_QUIC_PORTS_NAME "send_quic_ports"
+#define FD_METRICS_ENUM_SEND_QUIC_PORTS_CNT (2UL)
+#define FD_METRICS_ENUM_SEND_QUIC_PORTS_V_QUIC_VOTE_IDX  0
+#define FD_METRICS_ENUM_SEND_QUIC_PORTS_V_QUIC_VOTE_NAME "quic_vote"
+#define FD_METRICS_ENUM_SEND_QUIC_PORTS_V_QUIC_TPU_IDX  1
+#define FD_METRICS_ENUM_SEND_QUIC_PORTS_V_QUIC_TPU_NAME "quic_tpu"
+
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_NAME "send_ensure_conn_result"
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_CNT (5UL)
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_NO_LEADER_IDX  0
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_NO_LEADER_NAME "no_leader"
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_NO_CI_IDX  1
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_NO_CI_NAME "no_ci"
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_NEW_CONNECTION_IDX  2
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_NEW_CONNECTION_NAME "new_connection"
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_CONN_FAILED_IDX  3
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_CONN_FAILED_NAME "conn_failed"
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_CONNECTED_IDX  4
+#define FD_METRICS_ENUM_SEND_ENSURE_CONN_RESULT_V_CONNECTED_NAME "connected"
+
+#define FD_METRICS_ENUM_BUNDLE_ERROR_NAME "bundle_error"
+#define FD_METRICS_ENUM_BUNDLE_ERROR_CNT (5UL)
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_PROTOBUF_IDX  0
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_PROTOBUF_NAME "protobuf"
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_TRANSPORT_IDX  1
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_TRANSPORT_NAME "transport"
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_TIMEOUT_IDX  2
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_TIMEOUT_NAME "timeout"
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_NO_FEE_INFO_IDX  3
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_NO_FEE_INFO_NAME "no_fee_info"
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_SSL_ALLOC_IDX  4
+#define FD_METRICS_ENUM_BUNDLE_ERROR_V_SSL_ALLOC_NAME "ssl_alloc"
+
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_NAME "lut_resolve_result"
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_CNT (6UL)
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_INVALID_LOOKUP_INDEX_IDX  0
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_INVALID_LOOKUP_INDEX_NAME "invalid_lookup_index"
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_ACCOUNT_UNINITIALIZED_IDX  1
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_ACCOUNT_UNINITIALIZED_NAME "account_uninitialized"
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_INVALID_ACCOUNT_DATA_IDX  2
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_INVALID_ACCOUNT_DATA_NAME "invalid_account_data"
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_INVALID_ACCOUNT_OWNER_IDX  3
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_INVALID_ACCOUNT_OWNER_NAME "invalid_account_owner"
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_ACCOUNT_NOT_FOUND_IDX  4
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_ACCOUNT_NOT_FOUND_NAME "account_not_found"
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_SUCCESS_IDX  5
+#define FD_METRICS_ENUM_LUT_RESOLVE_RESULT_V_SUCCESS_NAME "success"
+
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_NAME "resolve_stash_operation"
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_CNT (4UL)
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_V_INSERTED_IDX  0
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_V_INSERTED_NAME "inserted"
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_V_OVERRUN_IDX  1
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_V_OVERRUN_NAME "overrun"
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_V_PUBLISHED_IDX  2
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_V_PUBLISHED_NAME "published"
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_V_REMOVED_IDX  3
+#define FD_METRICS_ENUM_RESOLVE_STASH_OPERATION_V_REMOVED_NAME "removed"
+
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_NAME "pack_txn_insert_return"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_CNT (21UL)
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONCE_CONFLICT_IDX  0
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONCE_CONFLICT_NAME "nonce_conflict"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_BUNDLE_BLACKLIST_IDX  1
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_BUNDLE_BLACKLIST_NAME "bundle_blacklist"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_INVALID_NONCE_IDX  2
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_INVALID_NONCE_NAME "invalid_nonce"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_WRITE_SYSVAR_IDX  3
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_WRITE_SYSVAR_NAME "write_sysvar"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_ESTIMATION_FAIL_IDX  4
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_ESTIMATION_FAIL_NAME "estimation_fail"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_DUPLICATE_ACCOUNT_IDX  5
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_DUPLICATE_ACCOUNT_NAME "duplicate_account"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_TOO_MANY_ACCOUNTS_IDX  6
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_TOO_MANY_ACCOUNTS_NAME "too_many_accounts"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_TOO_LARGE_IDX  7
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_TOO_LARGE_NAME "too_large"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_EXPIRED_IDX  8
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_EXPIRED_NAME "expired"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_ADDR_LUT_IDX  9
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_ADDR_LUT_NAME "addr_lut"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_UNAFFORDABLE_IDX  10
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_UNAFFORDABLE_NAME "unaffordable"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_DUPLICATE_IDX  11
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_DUPLICATE_NAME "duplicate"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONCE_PRIORITY_IDX  12
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONCE_PRIORITY_NAME "nonce_priority"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_PRIORITY_IDX  13
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_PRIORITY_NAME "priority"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONVOTE_ADD_IDX  14
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONVOTE_ADD_NAME "nonvote_add"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_VOTE_ADD_IDX  15
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_VOTE_ADD_NAME "vote_add"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONVOTE_REPLACE_IDX  16
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONVOTE_REPLACE_NAME "nonvote_replace"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_VOTE_REPLACE_IDX  17
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_VOTE_REPLACE_NAME "vote_replace"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONCE_NONVOTE_ADD_IDX  18
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONCE_NONVOTE_ADD_NAME "nonce_nonvote_add"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_UNUSED_IDX  19
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_UNUSED_NAME "unused"
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONCE_NONVOTE_REPLACE_IDX  20
+#define FD_METRICS_ENUM_PACK_TXN_INSERT_RETURN_V_NONCE_NONVOTE_REPLACE_NAME "nonce_nonvote_replace"
+
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_NAME "pack_txn_schedule"
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_CNT (7UL)
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_TAKEN_IDX  0
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_TAKEN_NAME "taken"
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_CU_LIMIT_IDX  1
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_CU_LIMIT_NAME "cu_limit"
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_FAST_PATH_IDX  2
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_FAST_PATH_NAME "fast_path"
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_BYTE_LIMIT_IDX  3
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_BYTE_LIMIT_NAME "byte_limit"
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_WRITE_COST_IDX  4
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_WRITE_COST_NAME "write_cost"
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_SLOW_PATH_IDX  5
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_SLOW_PATH_NAME "slow_path"
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_DEFER_SKIP_IDX  6
+#define FD_METRICS_ENUM_PACK_TXN_SCHEDULE_V_DEFER_SKIP_NAME "defer_skip"
+
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_NAME "pack_timing_state"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_CNT (16UL)
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_NO_BANK_NO_LEADER_NO_MICROBLOCK_IDX  0
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_NO_BANK_NO_LEADER_NO_MICROBLOCK_NAME "no_txn_no_bank_no_leader_no_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_NO_BANK_NO_LEADER_NO_MICROBLOCK_IDX  1
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_NO_BANK_NO_LEADER_NO_MICROBLOCK_NAME "txn_no_bank_no_leader_no_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_BANK_NO_LEADER_NO_MICROBLOCK_IDX  2
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_BANK_NO_LEADER_NO_MICROBLOCK_NAME "no_txn_bank_no_leader_no_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_BANK_NO_LEADER_NO_MICROBLOCK_IDX  3
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_BANK_NO_LEADER_NO_MICROBLOCK_NAME "txn_bank_no_leader_no_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_NO_BANK_LEADER_NO_MICROBLOCK_IDX  4
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_NO_BANK_LEADER_NO_MICROBLOCK_NAME "no_txn_no_bank_leader_no_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_NO_BANK_LEADER_NO_MICROBLOCK_IDX  5
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_NO_BANK_LEADER_NO_MICROBLOCK_NAME "txn_no_bank_leader_no_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_BANK_LEADER_NO_MICROBLOCK_IDX  6
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_BANK_LEADER_NO_MICROBLOCK_NAME "no_txn_bank_leader_no_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_BANK_LEADER_NO_MICROBLOCK_IDX  7
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_BANK_LEADER_NO_MICROBLOCK_NAME "txn_bank_leader_no_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_NO_BANK_NO_LEADER_MICROBLOCK_IDX  8
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_NO_BANK_NO_LEADER_MICROBLOCK_NAME "no_txn_no_bank_no_leader_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_NO_BANK_NO_LEADER_MICROBLOCK_IDX  9
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_NO_BANK_NO_LEADER_MICROBLOCK_NAME "txn_no_bank_no_leader_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_BANK_NO_LEADER_MICROBLOCK_IDX  10
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_BANK_NO_LEADER_MICROBLOCK_NAME "no_txn_bank_no_leader_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_BANK_NO_LEADER_MICROBLOCK_IDX  11
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_BANK_NO_LEADER_MICROBLOCK_NAME "txn_bank_no_leader_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_NO_BANK_LEADER_MICROBLOCK_IDX  12
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_NO_BANK_LEADER_MICROBLOCK_NAME "no_txn_no_bank_leader_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_NO_BANK_LEADER_MICROBLOCK_IDX  13
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_NO_BANK_LEADER_MICROBLOCK_NAME "txn_no_bank_leader_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_BANK_LEADER_MICROBLOCK_IDX  14
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_NO_TXN_BANK_LEADER_MICROBLOCK_NAME "no_txn_bank_leader_microblock"
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_BANK_LEADER_MICROBLOCK_IDX  15
+#define FD_METRICS_ENUM_PACK_TIMING_STATE_V_TXN_BANK_LEADER_MICROBLOCK_NAME "txn_bank_leader_microblock"
+
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_NAME "avail_txn_type"
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_CNT (5UL)
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_ALL_IDX  0
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_ALL_NAME "all"
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_REGULAR_IDX  1
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_REGULAR_NAME "regular"
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_VOTES_IDX  2
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_VOTES_NAME "votes"
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_CONFLICTING_IDX  3
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_CONFLICTING_NAME "conflicting"
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_BUNDLES_IDX  4
+#define FD_METRICS_ENUM_AVAIL_TXN_TYPE_V_BUNDLES_NAME "bundles"
+
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_NAME "bundle_crank_result"
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_CNT (4UL)
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_V_NOT_NEEDED_IDX  0
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_V_NOT_NEEDED_NAME "not_needed"
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_V_INSERTED_IDX  1
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_V_INSERTED_NAME "inserted"
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_V_CREATION_FAILED_IDX  2
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_V_CREATION_FAILED_NAME "creation_failed"
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_V_INSERTION_FAILED_IDX  3
+#define FD_METRICS_ENUM_BUNDLE_CRANK_RESULT_V_INSERTION_FAILED_NAME "insertion_failed"
+
+#define FD_METRICS_ENUM_BANK_SLOT_ACQUIRE_NAME "bank_slot_acquire"
+#define FD_METRICS_ENUM_BANK_SLOT_ACQUIRE_CNT (3UL)
+#define FD_METRICS_ENUM_BANK_SLOT_ACQUIRE_V_SUCCESS_IDX  0
+#define FD_METRICS_ENUM_BANK_SLOT_ACQUIRE_V_SUCCESS_NAME "success"
+#define FD_METRICS_ENUM_BANK_SLOT_ACQUIRE_V_TOO_HIGH_IDX  1
+#define FD_METRICS_ENUM_BANK_SLOT_ACQUIRE_V_TOO_HIGH_NAME "too_high"
+#define FD_METRICS_ENUM_BANK_SLOT_ACQUIRE_V_TOO_LOW_IDX  2
+#define FD_METRICS_ENUM_BANK_SLOT_ACQUIRE_V_TOO_LOW_NAME "too_low"
+
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_NAME "bank_load_address_lookup_table"
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_CNT (6UL)
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_SUCCESS_IDX  0
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_SUCCESS_NAME "success"
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_SLOT_HASHES_SYSVAR_NOT_FOUND_IDX  1
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_SLOT_HASHES_SYSVAR_NOT_FOUND_NAME "slot_hashes_sysvar_not_found"
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_ACCOUNT_NOT_FOUND_IDX  2
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_ACCOUNT_NOT_FOUND_NAME "account_not_found"
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_INVALID_ACCOUNT_OWNER_IDX  3
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_INVALID_ACCOUNT_OWNER_NAME "invalid_account_owner"
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_INVALID_ACCOUNT_DATA_IDX  4
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_INVALID_ACCOUNT_DATA_NAME "invalid_account_data"
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_INVALID_INDEX_IDX  5
+#define FD_METRICS_ENUM_BANK_LOAD_ADDRESS_LOOKUP_TABLE_V_INVALID_INDEX_NAME "invalid_index"
+
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_NAME "transaction_error"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_CNT (41UL)
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_SUCCESS_IDX  0
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_SUCCESS_NAME "success"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ACCOUNT_IN_USE_IDX  1
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ACCOUNT_IN_USE_NAME "account_in_use"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ACCOUNT_LOADED_TWICE_IDX  2
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ACCOUNT_LOADED_TWICE_NAME "account_loaded_twice"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ACCOUNT_NOT_FOUND_IDX  3
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ACCOUNT_NOT_FOUND_NAME "account_not_found"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_PROGRAM_ACCOUNT_NOT_FOUND_IDX  4
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_PROGRAM_ACCOUNT_NOT_FOUND_NAME "program_account_not_found"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INSUFFICIENT_FUNDS_FOR_FEE_IDX  5
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INSUFFICIENT_FUNDS_FOR_FEE_NAME "insufficient_funds_for_fee"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ACCOUNT_FOR_FEE_IDX  6
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ACCOUNT_FOR_FEE_NAME "invalid_account_for_fee"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ALREADY_PROCESSED_IDX  7
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ALREADY_PROCESSED_NAME "already_processed"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_BLOCKHASH_NOT_FOUND_IDX  8
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_BLOCKHASH_NOT_FOUND_NAME "blockhash_not_found"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INSTRUCTION_ERROR_IDX  9
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INSTRUCTION_ERROR_NAME "instruction_error"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_CALL_CHAIN_TOO_DEEP_IDX  10
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_CALL_CHAIN_TOO_DEEP_NAME "call_chain_too_deep"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_MISSING_SIGNATURE_FOR_FEE_IDX  11
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_MISSING_SIGNATURE_FOR_FEE_NAME "missing_signature_for_fee"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ACCOUNT_INDEX_IDX  12
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ACCOUNT_INDEX_NAME "invalid_account_index"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_SIGNATURE_FAILURE_IDX  13
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_SIGNATURE_FAILURE_NAME "signature_failure"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_PROGRAM_FOR_EXECUTION_IDX  14
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_PROGRAM_FOR_EXECUTION_NAME "invalid_program_for_execution"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_SANITIZE_FAILURE_IDX  15
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_SANITIZE_FAILURE_NAME "sanitize_failure"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_CLUSTER_MAINTENANCE_IDX  16
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_CLUSTER_MAINTENANCE_NAME "cluster_maintenance"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ACCOUNT_BORROW_OUTSTANDING_IDX  17
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ACCOUNT_BORROW_OUTSTANDING_NAME "account_borrow_outstanding"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_MAX_BLOCK_COST_LIMIT_IDX  18
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_MAX_BLOCK_COST_LIMIT_NAME "would_exceed_max_block_cost_limit"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_UNSUPPORTED_VERSION_IDX  19
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_UNSUPPORTED_VERSION_NAME "unsupported_version"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_WRITABLE_ACCOUNT_IDX  20
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_WRITABLE_ACCOUNT_NAME "invalid_writable_account"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_MAX_ACCOUNT_COST_LIMIT_IDX  21
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_MAX_ACCOUNT_COST_LIMIT_NAME "would_exceed_max_account_cost_limit"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_ACCOUNT_DATA_BLOCK_LIMIT_IDX  22
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_ACCOUNT_DATA_BLOCK_LIMIT_NAME "would_exceed_account_data_block_limit"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_TOO_MANY_ACCOUNT_LOCKS_IDX  23
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_TOO_MANY_ACCOUNT_LOCKS_NAME "too_many_account_locks"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ADDRESS_LOOKUP_TABLE_NOT_FOUND_IDX  24
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_ADDRESS_LOOKUP_TABLE_NOT_FOUND_NAME "address_lookup_table_not_found"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ADDRESS_LOOKUP_TABLE_OWNER_IDX  25
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ADDRESS_LOOKUP_TABLE_OWNER_NAME "invalid_address_lookup_table_owner"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ADDRESS_LOOKUP_TABLE_DATA_IDX  26
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ADDRESS_LOOKUP_TABLE_DATA_NAME "invalid_address_lookup_table_data"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ADDRESS_LOOKUP_TABLE_INDEX_IDX  27
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_ADDRESS_LOOKUP_TABLE_INDEX_NAME "invalid_address_lookup_table_index"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_RENT_PAYING_ACCOUNT_IDX  28
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_RENT_PAYING_ACCOUNT_NAME "invalid_rent_paying_account"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_MAX_VOTE_COST_LIMIT_IDX  29
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_MAX_VOTE_COST_LIMIT_NAME "would_exceed_max_vote_cost_limit"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_ACCOUNT_DATA_TOTAL_LIMIT_IDX  30
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_WOULD_EXCEED_ACCOUNT_DATA_TOTAL_LIMIT_NAME "would_exceed_account_data_total_limit"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_DUPLICATE_INSTRUCTION_IDX  31
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_DUPLICATE_INSTRUCTION_NAME "duplicate_instruction"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INSUFFICIENT_FUNDS_FOR_RENT_IDX  32
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INSUFFICIENT_FUNDS_FOR_RENT_NAME "insufficient_funds_for_rent"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_MAX_LOADED_ACCOUNTS_DATA_SIZE_EXCEEDED_IDX  33
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_MAX_LOADED_ACCOUNTS_DATA_SIZE_EXCEEDED_NAME "max_loaded_accounts_data_size_exceeded"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_LOADED_ACCOUNTS_DATA_SIZE_LIMIT_IDX  34
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_INVALID_LOADED_ACCOUNTS_DATA_SIZE_LIMIT_NAME "invalid_loaded_accounts_data_size_limit"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_RESANITIZATION_NEEDED_IDX  35
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_RESANITIZATION_NEEDED_NAME "resanitization_needed"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_PROGRAM_EXECUTION_TEMPORARILY_RESTRICTED_IDX  36
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_PROGRAM_EXECUTION_TEMPORARILY_RESTRICTED_NAME "program_execution_temporarily_restricted"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_UNBALANCED_TRANSACTION_IDX  37
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_UNBALANCED_TRANSACTION_NAME "unbalanced_transaction"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_PROGRAM_CACHE_HIT_MAX_LIMIT_IDX  38
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_PROGRAM_CACHE_HIT_MAX_LIMIT_NAME "program_cache_hit_max_limit"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_COMMIT_CANCELLED_IDX  39
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_COMMIT_CANCELLED_NAME "commit_cancelled"
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_BUNDLE_PEER_IDX  40
+#define FD_METRICS_ENUM_TRANSACTION_ERROR_V_BUNDLE_PEER_NAME "bundle_peer"
+
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_NAME "shred_processing_result"
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_CNT (6UL)
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_BAD_SLOT_IDX  0
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_BAD_SLOT_NAME "bad_slot"
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_PARSE_FAILED_IDX  1
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_PARSE_FAILED_NAME "parse_failed"
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_REJECTED_IDX  2
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_REJECTED_NAME "rejected"
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_IGNORED_IDX  3
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_IGNORED_NAME "ignored"
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_OKAY_IDX  4
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_OKAY_NAME "okay"
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_COMPLETES_IDX  5
+#define FD_METRICS_ENUM_SHRED_PROCESSING_RESULT_V_COMPLETES_NAME "completes"
+
+#define FD_METRICS_ENUM_REPAIR_SENT_REQUEST_TYPES_NAME "repair_sent_request_types"
+#define FD_METRICS_ENUM_REPAIR_SENT_REQUEST_TYPES_CNT (3UL)
+#define FD_METRICS_ENUM_REPAIR_SENT_REQUEST_TYPES_V_NEEDED_WINDOW_IDX  0
+#define FD_METRICS_ENUM_REPAIR_SENT_REQUEST_TYPES_V_NEEDED_WINDOW_NAME "needed_window"
+#define FD_METRICS_ENUM_REPAIR_SENT_REQUEST_TYPES_V_NEEDED_HIGHEST_WINDOW_IDX  1
+#define FD_METRICS_ENUM_REPAIR_SENT_REQUEST_TYPES_V_NEEDED_HIGHEST_WINDOW_NAME "needed_highest_window"
+#define FD_METRICS_ENUM_REPAIR_SENT_REQUEST_TYPES_V_NEEDED_ORPHAN_IDX  2
+#define FD_METRICS_ENUM_REPAIR_SENT_REQUEST_TYPES_V_NEEDED_ORPHAN_NAME "needed_orphan"
+
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_NAME "repair_serv_pkt_types"
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_CNT (5UL)
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_PONG_IDX  0
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_PONG_NAME "pong"
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_WINDOW_IDX  1
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_WINDOW_NAME "window"
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_HIGHEST_WINDOW_IDX  2
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_HIGHEST_WINDOW_NAME "highest_window"
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_ORPHAN_IDX  3
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_ORPHAN_NAME "orphan"
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_UNKNOWN_IDX  4
+#define FD_METRICS_ENUM_REPAIR_SERV_PKT_TYPES_V_UNKNOWN_NAME "unknown"
+
+#define FD_METRICS_ENUM_CRDS_VALUE_NAME "crds_value"
+#define FD_METRICS_ENUM_CRDS_VALUE_CNT (14UL)
+#define FD_METRICS_ENUM_CRDS_VALUE_V_CONTACT_INFO_V1_IDX  0
+#define FD_METRICS_ENUM_CRDS_VALUE_V_CONTACT_INFO_V1_NAME "contact_info_v1"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_VOTE_IDX  1
+#define FD_METRICS_ENUM_CRDS_VALUE_V_VOTE_NAME "vote"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_LOWEST_SLOT_IDX  2
+#define FD_METRICS_ENUM_CRDS_VALUE_V_LOWEST_SLOT_NAME "lowest_slot"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_SNAPSHOT_HASHES_IDX  3
+#define FD_METRICS_ENUM_CRDS_VALUE_V_SNAPSHOT_HASHES_NAME "snapshot_hashes"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_ACCOUNTS_HASHES_IDX  4
+#define FD_METRICS_ENUM_CRDS_VALUE_V_ACCOUNTS_HASHES_NAME "accounts_hashes"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_EPOCH_SLOTS_IDX  5
+#define FD_METRICS_ENUM_CRDS_VALUE_V_EPOCH_SLOTS_NAME "epoch_slots"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_VERSION_V1_IDX  6
+#define FD_METRICS_ENUM_CRDS_VALUE_V_VERSION_V1_NAME "version_v1"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_VERSION_V2_IDX  7
+#define FD_METRICS_ENUM_CRDS_VALUE_V_VERSION_V2_NAME "version_v2"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_NODE_INSTANCE_IDX  8
+#define FD_METRICS_ENUM_CRDS_VALUE_V_NODE_INSTANCE_NAME "node_instance"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_DUPLICATE_SHRED_IDX  9
+#define FD_METRICS_ENUM_CRDS_VALUE_V_DUPLICATE_SHRED_NAME "duplicate_shred"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_INCREMENTAL_SNAPSHOT_HASHES_IDX  10
+#define FD_METRICS_ENUM_CRDS_VALUE_V_INCREMENTAL_SNAPSHOT_HASHES_NAME "incremental_snapshot_hashes"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_CONTACT_INFO_V2_IDX  11
+#define FD_METRICS_ENUM_CRDS_VALUE_V_CONTACT_INFO_V2_NAME "contact_info_v2"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_RESTART_LAST_VOTED_FORK_SLOTS_IDX  12
+#define FD_METRICS_ENUM_CRDS_VALUE_V_RESTART_LAST_VOTED_FORK_SLOTS_NAME "restart_last_voted_fork_slots"
+#define FD_METRICS_ENUM_CRDS_VALUE_V_RESTART_HEAVIEST_FORK_IDX  13
+#define FD_METRICS_ENUM_CRDS_VALUE_V_RESTART_HEAVIEST_FORK_NAME "restart_heaviest_fork"
+
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_NAME "gossip_message"
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_CNT (6UL)
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PULL_REQUEST_IDX  0
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PULL_REQUEST_NAME "pull_request"
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PULL_RESPONSE_IDX  1
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PULL_RESPONSE_NAME "pull_response"
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PUSH_IDX  2
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PUSH_NAME "push"
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PRUNE_IDX  3
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PRUNE_NAME "prune"
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PING_IDX  4
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PING_NAME "ping"
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PONG_IDX  5
+#define FD_METRICS_ENUM_GOSSIP_MESSAGE_V_PONG_NAME "pong"
+
+#define FD_METRICS_ENUM_PONG_RESPONSE_NAME "pong_response"
+#define FD_METRICS_ENUM_PONG_RESPONSE_CNT (6UL)
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_STAKED_IDX  0
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_STAKED_NAME "staked"
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_ENTRYPOINT_IDX  1
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_ENTRYPOINT_NAME "entrypoint"
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_UNTRACKED_IDX  2
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_UNTRACKED_NAME "untracked"
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_ADDRESS_IDX  3
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_ADDRESS_NAME "address"
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_TOKEN_IDX  4
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_TOKEN_NAME "token"
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_SUCCESS_IDX  5
+#define FD_METRICS_ENUM_PONG_RESPONSE_V_SUCCESS_NAME "success"
+
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_NAME "ping_tracked_type"
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_CNT (4UL)
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_V_UNPINGED_IDX  0
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_V_UNPINGED_NAME "unpinged"
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_V_INVALID_IDX  1
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_V_INVALID_NAME "invalid"
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_V_VALID_IDX  2
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_V_VALID_NAME "valid"
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_V_VALID_REFRESHING_IDX  3
+#define FD_METRICS_ENUM_PING_TRACKED_TYPE_V_VALID_REFRESHING_NAME "valid_refreshing"
+
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_NAME "gossip_crds_outcome"
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_CNT (7UL)
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_UPSERTED_PULL_RESPONSE_IDX  0
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_UPSERTED_PULL_RESPONSE_NAME "upserted_pull_response"
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_UPSERTED_PUSH_IDX  1
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_UPSERTED_PUSH_NAME "upserted_push"
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_STALE_IDX  2
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_STALE_NAME "dropped_pull_response_stale"
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_WALLCLOCK_IDX  3
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_WALLCLOCK_NAME "dropped_pull_response_wallclock"
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_DUPLICATE_IDX  4
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_DUPLICATE_NAME "dropped_pull_response_duplicate"
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PUSH_STALE_IDX  5
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PUSH_STALE_NAME "dropped_push_stale"
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PUSH_DUPLICATE_IDX  6
+#define FD_METRICS_ENUM_GOSSIP_CRDS_OUTCOME_V_DROPPED_PUSH_DUPLICATE_NAME "dropped_push_duplicate"
+
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_NAME "gossvf_message_outcome"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_CNT (20UL)
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PULL_REQUEST_IDX  0
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PULL_REQUEST_NAME "success_pull_request"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PULL_RESPONSE_IDX  1
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PULL_RESPONSE_NAME "success_pull_response"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PUSH_IDX  2
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PUSH_NAME "success_push"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PRUNE_IDX  3
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PRUNE_NAME "success_prune"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PING_IDX  4
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PING_NAME "success_ping"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PONG_IDX  5
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_SUCCESS_PONG_NAME "success_pong"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_UNPARSEABLE_IDX  6
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_UNPARSEABLE_NAME "dropped_unparseable"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_NOT_CONTACT_INFO_IDX  7
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_NOT_CONTACT_INFO_NAME "dropped_pull_request_not_contact_info"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_LOOPBACK_IDX  8
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_LOOPBACK_NAME "dropped_pull_request_loopback"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_INACTIVE_IDX  9
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_INACTIVE_NAME "dropped_pull_request_inactive"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_WALLCLOCK_IDX  10
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_WALLCLOCK_NAME "dropped_pull_request_wallclock"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_SIGNATURE_IDX  11
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_SIGNATURE_NAME "dropped_pull_request_signature"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_SHRED_VERSION_IDX  12
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_REQUEST_SHRED_VERSION_NAME "dropped_pull_request_shred_version"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PRUNE_DESTINATION_IDX  13
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PRUNE_DESTINATION_NAME "dropped_prune_destination"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PRUNE_WALLCLOCK_IDX  14
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PRUNE_WALLCLOCK_NAME "dropped_prune_wallclock"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PRUNE_SIGNATURE_IDX  15
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PRUNE_SIGNATURE_NAME "dropped_prune_signature"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PUSH_NO_VALID_CRDS_IDX  16
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PUSH_NO_VALID_CRDS_NAME "dropped_push_no_valid_crds"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_RESPONSE_NO_VALID_CRDS_IDX  17
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PULL_RESPONSE_NO_VALID_CRDS_NAME "dropped_pull_response_no_valid_crds"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PING_SIGNATURE_IDX  18
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PING_SIGNATURE_NAME "dropped_ping_signature"
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PONG_SIGNATURE_IDX  19
+#define FD_METRICS_ENUM_GOSSVF_MESSAGE_OUTCOME_V_DROPPED_PONG_SIGNATURE_NAME "dropped_pong_signature"
+
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_NAME "gossvf_crds_outcome"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_CNT (16UL)
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_SUCCESS_PULL_RESPONSE_IDX  0
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_SUCCESS_PULL_RESPONSE_NAME "success_pull_response"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_SUCCESS_PUSH_IDX  1
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_SUCCESS_PUSH_NAME "success_push"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_DUPLICATE_IDX  2
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_DUPLICATE_NAME "dropped_pull_response_duplicate"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_SIGNATURE_IDX  3
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_SIGNATURE_NAME "dropped_pull_response_signature"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_RELAYER_NO_CONTACT_INFO_IDX  4
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_RELAYER_NO_CONTACT_INFO_NAME "dropped_pull_response_relayer_no_contact_info"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_RELAYER_SHRED_VERSION_IDX  5
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_RELAYER_SHRED_VERSION_NAME "dropped_pull_response_relayer_shred_version"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_ORIGIN_NO_CONTACT_INFO_IDX  6
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_ORIGIN_NO_CONTACT_INFO_NAME "dropped_pull_response_origin_no_contact_info"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_ORIGIN_SHRED_VERSION_IDX  7
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_ORIGIN_SHRED_VERSION_NAME "dropped_pull_response_origin_shred_version"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_INACTIVE_IDX  8
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PULL_RESPONSE_INACTIVE_NAME "dropped_pull_response_inactive"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_SIGNATURE_IDX  9
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_SIGNATURE_NAME "dropped_push_signature"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_RELAYER_NO_CONTACT_INFO_IDX  10
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_RELAYER_NO_CONTACT_INFO_NAME "dropped_push_relayer_no_contact_info"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_RELAYER_SHRED_VERSION_IDX  11
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_RELAYER_SHRED_VERSION_NAME "dropped_push_relayer_shred_version"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_ORIGIN_NO_CONTACT_INFO_IDX  12
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_ORIGIN_NO_CONTACT_INFO_NAME "dropped_push_origin_no_contact_info"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_ORIGIN_SHRED_VERSION_IDX  13
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_ORIGIN_SHRED_VERSION_NAME "dropped_push_origin_shred_version"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_INACTIVE_IDX  14
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_INACTIVE_NAME "dropped_push_inactive"
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_WALLCLOCK_IDX  15
+#define FD_METRICS_ENUM_GOSSVF_CRDS_OUTCOME_V_DROPPED_PUSH_WALLCLOCK_NAME "dropped_push_wallclock"
+
+#define FD_METRICS_ENUM_NETLINK_MSG_NAME "netlink_msg"
+#define FD_METRICS_ENUM_NETLINK_MSG_CNT (3UL)
+#define FD_METRICS_ENUM_NETLINK_MSG_V_LINK_IDX  0
+#define FD_METRICS_ENUM_NETLINK_MSG_V_LINK_NAME "link"
+#define FD_METRICS_ENUM_NETLINK_MSG_V_NEIGH_IDX  1
+#define FD_METRICS_ENUM_NETLINK_MSG_V_NEIGH_NAME "neigh"
+#define FD_METRICS_ENUM_NETLINK_MSG_V_IPV4_ROUTE_IDX  2
+#define FD_METRICS_ENUM_NETLINK_MSG_V_IPV4_ROUTE_NAME "ipv4_route"
+
+#define FD_METRICS_ENUM_ROUTE_TABLE_NAME "route_table"
+#define FD_METRICS_ENUM_ROUTE_TABLE_CNT (2UL)
+#define FD_METRICS_ENUM_ROUTE_TABLE_V_LOCAL_IDX  0
+#define FD_METRICS_ENUM_ROUTE_TABLE_V_LOCAL_NAME "local"
+#define FD_METRICS_ENUM_ROUTE_TABLE_V_MAIN_IDX  1
+#define FD_METRICS_ENUM_ROUTE_TABLE_V_MAIN_NAME "main"
+
@@ -0,0 +1,13 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_OFF  (16UL)
+#define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_NAME "metric_boot_timestamp_nanos"
+#define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_DESC "Timestamp when validator was started (nanoseconds since epoch)"
+#define FD_METRICS_GAUGE_METRIC_BOOT_TIMESTAMP_NANOS_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_METRIC_TOTAL (1UL)
+extern const fd_metrics_meta_t FD_METRICS_METRIC[FD_METRICS_METRIC_TOTAL];
@@ -0,0 +1,51 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_GAUGE_REPLAY_SLOT_OFF  (16UL)
+#define FD_METRICS_GAUGE_REPLAY_SLOT_NAME "replay_slot"
+#define FD_METRICS_GAUGE_REPLAY_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_REPLAY_SLOT_DESC ""
+#define FD_METRICS_GAUGE_REPLAY_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_OFF  (17UL)
+#define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_NAME "replay_last_voted_slot"
+#define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_TYPE (FD_METRICS_TYPE_GAUGE)
+#define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_DESC ""
+#define FD_METRICS_GAUGE_REPLAY_LAST_VOTED_SLOT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_OFF  (18UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_NAME "replay_store_read_wait"
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_DESC "Time in seconds spent waiting for the store to read a FEC set"
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_MIN  (1e-08)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WAIT_MAX  (0.001)
+
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_OFF  (35UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_NAME "replay_store_read_work"
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_DESC "Time in seconds spent on reading a FEC set"
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_MIN  (1e-08)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_READ_WORK_MAX  (0.001)
+
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_OFF  (52UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_NAME "replay_store_publish_wait"
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_DESC "Time in seconds spent waiting for the store to publish a new FEC set"
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_MIN  (1e-08)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WAIT_MAX  (0.001)
+
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_OFF  (69UL)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_NAME "replay_store_publish_work"
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_DESC "Time in seconds spent on publishing a new FEC set"
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_MIN  (1e-08)
+#define FD_METRICS_HISTOGRAM_REPLAY_STORE_PUBLISH_WORK_MAX  (0.001)
+
+#define FD_METRICS_REPLAY_TOTAL (6UL)
+extern const fd_metrics_meta_t FD_METRICS_REPLAY[FD_METRICS_REPLAY_TOTAL];
@@ -0,0 +1,15 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_OFF  (16UL)
+#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_NAME "sign_sign_duration_seconds"
+#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_TYPE (FD_METRICS_TYPE_HISTOGRAM)
+#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_DESC "Duration of signing a message"
+#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_CVT  (FD_METRICS_CONVERTER_SECONDS)
+#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_MIN  (1e-08)
+#define FD_METRICS_HISTOGRAM_SIGN_SIGN_DURATION_SECONDS_MAX  (0.001)
+
+#define FD_METRICS_SIGN_TOTAL (1UL)
+extern const fd_metrics_meta_t FD_METRICS_SIGN[FD_METRICS_SIGN_TOTAL];
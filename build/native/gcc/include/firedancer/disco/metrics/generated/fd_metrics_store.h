@@ -0,0 +1,13 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_COUNTER_STORE_TRANSACTIONS_INSERTED_OFF  (16UL)
+#define FD_METRICS_COUNTER_STORE_TRANSACTIONS_INSERTED_NAME "store_transactions_inserted"
+#define FD_METRICS_COUNTER_STORE_TRANSACTIONS_INSERTED_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_STORE_TRANSACTIONS_INSERTED_DESC "Count of transactions produced while we were leader in the shreds that have been inserted so far"
+#define FD_METRICS_COUNTER_STORE_TRANSACTIONS_INSERTED_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_STORE_TOTAL (1UL)
+extern const fd_metrics_meta_t FD_METRICS_STORE[FD_METRICS_STORE_TOTAL];
@@ -0,0 +1,31 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_BUNDLE_PEER_FAILURE_OFF  (16UL)
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_BUNDLE_PEER_FAILURE_NAME "verify_transaction_bundle_peer_failure"
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_BUNDLE_PEER_FAILURE_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_BUNDLE_PEER_FAILURE_DESC "Count of transactions that failed to verify because a peer transaction in the bundle failed"
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_BUNDLE_PEER_FAILURE_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_PARSE_FAILURE_OFF  (17UL)
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_PARSE_FAILURE_NAME "verify_transaction_parse_failure"
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_PARSE_FAILURE_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_PARSE_FAILURE_DESC "Count of transactions that failed to parse"
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_PARSE_FAILURE_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_DEDUP_FAILURE_OFF  (18UL)
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_DEDUP_FAILURE_NAME "verify_transaction_dedup_failure"
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_DEDUP_FAILURE_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_DEDUP_FAILURE_DESC "Count of transactions that failed to deduplicate in the verify stage"
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_DEDUP_FAILURE_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_OFF  (19UL)
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_NAME "verify_transaction_verify_failure"
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_DESC "Count of transactions that failed to deduplicate in the verify stage"
+#define FD_METRICS_COUNTER_VERIFY_TRANSACTION_VERIFY_FAILURE_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_VERIFY_TOTAL (4UL)
+extern const fd_metrics_meta_t FD_METRICS_VERIFY[FD_METRICS_VERIFY_TOTAL];
@@ -0,0 +1,43 @@
+/* THIS FILE IS GENERATED BY gen_metrics.py. DO NOT HAND EDIT. */
+
+#include "../fd_metrics_base.h"
+#include "fd_metrics_enums.h"
+
+#define FD_METRICS_COUNTER_VNET_RX_PKT_CNT_OFF  (16UL)
+#define FD_METRICS_COUNTER_VNET_RX_PKT_CNT_NAME "vnet_rx_pkt_cnt"
+#define FD_METRICS_COUNTER_VNET_RX_PKT_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VNET_RX_PKT_CNT_DESC "Number of packets published to RX links (replayed or looped back)"
+#define FD_METRICS_COUNTER_VNET_RX_PKT_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VNET_RX_BYTES_TOTAL_OFF  (17UL)
+#define FD_METRICS_COUNTER_VNET_RX_BYTES_TOTAL_NAME "vnet_rx_bytes_total"
+#define FD_METRICS_COUNTER_VNET_RX_BYTES_TOTAL_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VNET_RX_BYTES_TOTAL_DESC "Total number of bytes published to RX links (including Ethernet header)."
+#define FD_METRICS_COUNTER_VNET_RX_BYTES_TOTAL_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VNET_TX_PKT_CNT_OFF  (18UL)
+#define FD_METRICS_COUNTER_VNET_TX_PKT_CNT_NAME "vnet_tx_pkt_cnt"
+#define FD_METRICS_COUNTER_VNET_TX_PKT_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VNET_TX_PKT_CNT_DESC "Number of packets received on TX links"
+#define FD_METRICS_COUNTER_VNET_TX_PKT_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VNET_TX_BYTES_TOTAL_OFF  (19UL)
+#define FD_METRICS_COUNTER_VNET_TX_BYTES_TOTAL_NAME "vnet_tx_bytes_total"
+#define FD_METRICS_COUNTER_VNET_TX_BYTES_TOTAL_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VNET_TX_BYTES_TOTAL_DESC "Total number of bytes received on TX links (including Ethernet header)."
+#define FD_METRICS_COUNTER_VNET_TX_BYTES_TOTAL_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VNET_TX_LOOPBACK_CNT_OFF  (20UL)
+#define FD_METRICS_COUNTER_VNET_TX_LOOPBACK_CNT_NAME "vnet_tx_loopback_cnt"
+#define FD_METRICS_COUNTER_VNET_TX_LOOPBACK_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VNET_TX_LOOPBACK_CNT_DESC "Number of TX packets looped back to an RX link"
+#define FD_METRICS_COUNTER_VNET_TX_LOOPBACK_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_COUNTER_VNET_REPLAY_CNT_OFF  (21UL)
+#define FD_METRICS_COUNTER_VNET_REPLAY_CNT_NAME "vnet_replay_cnt"
+#define FD_METRICS_COUNTER_VNET_REPLAY_CNT_TYPE (FD_METRICS_TYPE_COUNTER)
+#define FD_METRICS_COUNTER_VNET_REPLAY_CNT_DESC "Number of completed passes over the pcap file"
+#define FD_METRICS_COUNTER_VNET_REPLAY_CNT_CVT  (FD_METRICS_CONVERTER_NONE)
+
+#define FD_METRICS_VNET_TOTAL (6UL)
+extern const fd_metrics_meta_t FD_METRICS_VNET[FD_METRICS_VNET_TOTAL];
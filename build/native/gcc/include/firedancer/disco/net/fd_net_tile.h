@@ -0,0 +1,248 @@
+#ifndef HEADER_fd_src_disco_net_fd_net_tile_h
+#define HEADER_fd_src_disco_net_fd_net_tile_h
+
+/* fd_net_tile.h contains APIs for providing XDP networking to a
+   Firedancer topology using the 'net' tile. */
+
+#include "../fd_disco_base.h"
+#include "../../tango/dcache/fd_dcache.h"
+
+struct fd_topo;
+typedef struct fd_topo fd_topo_t;
+
+/* FD_NET_JUMBO_MTU is the largest Ethernet frame (excluding FCS) the
+   net tile handles with XDP multi-buffer enabled.  This fits a 9000
+   byte IP MTU plus Ethernet and GRE headers.  FD_NET_JUMBO_PAYLOAD_MAX
+   is the corresponding max Ethernet payload size.
+
+   FD_NET_PKT_FRAME_MAX is the max number of UMEM frames a packet can
+   span.  Drivers reserve up to 256 bytes headroom per frame, leaving at
+   least FD_NET_MTU-256 bytes of packet data per frame. */
+
+#define FD_NET_JUMBO_MTU         (9216UL)
+#define FD_NET_JUMBO_PAYLOAD_MAX (9000UL)
+#define FD_NET_PKT_FRAME_MAX        (6UL)
+
+/* Net tile RX frags use the frag_meta ctl field to carry the offset of
+   the first packet byte relative to the chunk address (bits 0..5),
+   see fd_net_rx_translate_frag.
+
+   With XDP multi-buffer enabled, a packet larger than a UMEM frame is
+   published as a run of frags, one per frame, at consecutive seq
+   numbers with the same sig.  FD_NET_RX_CTL_CONT is set on every frag
+   of the run except the first, FD_NET_RX_CTL_MORE is set on every frag
+   except the last.  Packets fitting into a single frame have neither
+   flag set.  The first frag contains the Ethernet, IP, and UDP headers.
+   Use fd_net_rx_gather_t to reassemble such packets.
+
+   No RX consumer does so yet, and they would treat each piece as a
+   standalone packet, so multi-buffer is rejected at config validation
+   (net.xdp.xdp_multi_buffer) until they do. */
+
+#define FD_NET_RX_CTL_OFF_MASK (0x3fUL)
+#define FD_NET_RX_CTL_MORE     (0x40UL)
+#define FD_NET_RX_CTL_CONT     (0x80UL)
+
+/* Helpers for consumers of net tile RX packets */
+
+struct fd_net_rx_bounds {
+  ulong base;       /* base address of wksp containing dcache */
+  ulong pkt_lo;     /* lowest permitted pointer to packet payload */
+  ulong pkt_wmark;  /* highest " */
+};
+
+typedef struct fd_net_rx_bounds fd_net_rx_bounds_t;
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_net_rx_bounds_init initializes a bounds checker for RX packets
+   produced by the net tile.  dcache is a local join to a dcache that
+   will carry packet payloads. */
+
+FD_FN_UNUSED static void
+fd_net_rx_bounds_init( fd_net_rx_bounds_t * bounds,
+                       void *               dcache ) {
+  bounds->base      = (ulong)fd_wksp_containing( dcache );
+  bounds->pkt_lo    = (ulong)dcache;
+  bounds->pkt_wmark = bounds->pkt_lo + fd_dcache_data_sz( dcache ) - FD_NET_MTU;
+  if( FD_UNLIKELY( !bounds->base ) ) FD_LOG_ERR(( "Failed to find wksp containing dcache" ));
+}
+
+/* fd_net_rx_translate_frag helps net tile consumers locate packet
+   paylads.  bounds is a net_rx_bounds object for the net tile that the
+   frag was received from.  chunk, ctl, sz are frag_meta parameters.
+
+   Returns a pointer in the local address space to the first byte of an
+   incoming packet (or of the packet piece, for multi-frame packets).
+   Terminates the application if the given {chunk,ctl} params would
+   produce an out of bounds buffer. */
+
+FD_FN_UNUSED static void const *
+fd_net_rx_translate_frag( fd_net_rx_bounds_t const * bounds,
+                          ulong                      chunk,
+                          ulong                      ctl,
+                          ulong                      sz ) {
+  ulong p = ((ulong)bounds->base + (chunk<<FD_CHUNK_LG_SZ) + (ctl & FD_NET_RX_CTL_OFF_MASK));
+  if( FD_UNLIKELY( !( (p  >= bounds->pkt_lo   ) &
+                      (p  <= bounds->pkt_wmark) &
+                      (sz <= FD_NET_MTU       ) ) ) ) {
+    FD_LOG_ERR(( "frag %p (chunk=%lu ctl=%lu sz=%lu) is not in bounds [%p:%p]",
+                 (void *)p, chunk, ctl, sz,
+                 (void *)bounds->pkt_lo, (void *)bounds->pkt_wmark ));
+  }
+  return (void const *)p;
+}
+
+FD_PROTOTYPES_END
+
+/* fd_net_rx_gather_t reassembles multi-frame packets produced by the
+   net tile (see FD_NET_RX_CTL_{MORE,CONT}) by copying every frame of
+   the packet, from the net tile's UMEM, into a consumer provided
+   buffer.  This is not zero copy: consumers that parse frags in place
+   pay one extra copy per packet (single frame packets included) when
+   switching to it.  Copying can't be avoided, since frames are recycled
+   by the net tile once their frag is overrun, so pieces cannot be
+   referenced across frags.
+
+   Usage from a stem consumer:
+
+     during_frag: fd_net_rx_gather_copy( gather, bounds, seq, chunk, ctl, sz );
+     after_frag:  ulong pkt_sz = fd_net_rx_gather_commit( gather, seq, ctl );
+                  if( pkt_sz ) { ... packet is at gather->buf ... }
+
+   Single frame packets work the same way (complete in one frag).
+   Incomplete packets (overrun mid-run, or exceeding the buffer) are
+   silently dropped. */
+
+struct fd_net_rx_gather {
+  uchar * buf;     /* reassembly buffer */
+  ulong   buf_sz;  /* capacity of buf, e.g. FD_NET_JUMBO_MTU */
+  ulong   sz;      /* bytes committed for the packet in progress */
+  ulong   frag_sz; /* bytes copied by the last gather_copy, ULONG_MAX if dropped */
+  ulong   seq;     /* expected seq of the next CONT frag */
+  int     active;  /* 1 if a packet is in progress */
+};
+
+typedef struct fd_net_rx_gather fd_net_rx_gather_t;
+
+FD_PROTOTYPES_BEGIN
+
+FD_FN_UNUSED static fd_net_rx_gather_t *
+fd_net_rx_gather_init( fd_net_rx_gather_t * gather,
+                       void *               buf,
+                       ulong                buf_sz ) {
+  *gather = (fd_net_rx_gather_t) {
+    .buf     = buf,
+    .buf_sz  = buf_sz,
+    .frag_sz = ULONG_MAX
+  };
+  return gather;
+}
+
+/* fd_net_rx_gather_copy speculatively copies the packet piece carried
+   by a net tile RX frag into the gather buffer.  Should be called from
+   during_frag.  Does not modify gather state other than frag_sz, so an
+   overrun copy is harmless. */
+
+FD_FN_UNUSED static void
+fd_net_rx_gather_copy( fd_net_rx_gather_t *       gather,
+                       fd_net_rx_bounds_t const * bounds,
+                       ulong                      seq,
+                       ulong                      chunk,
+                       ulong                      ctl,
+                       ulong                      sz ) {
+  uchar const * src = fd_net_rx_translate_frag( bounds, chunk, ctl, sz );
+  ulong         off = 0UL;
+  if( ctl & FD_NET_RX_CTL_CONT ) {
+    if( FD_UNLIKELY( !gather->active || seq!=gather->seq ) ) {
+      gather->frag_sz = ULONG_MAX; /* head of packet was missed */
+      return;
+    }
+    off = gather->sz;
+  }
+  if( FD_UNLIKELY( off+sz > gather->buf_sz ) ) {
+    gather->frag_sz = ULONG_MAX; /* packet too large */
+    return;
+  }
+  fd_memcpy( gather->buf+off, src, sz );
+  gather->frag_sz = sz;
+}
+
+/* fd_net_rx_gather_commit appends the piece copied by the preceding
+   fd_net_rx_gather_copy to the packet in progress.  Should be called
+   from after_frag.  Returns the size of the packet at gather->buf if
+   this frag completed a packet.  Returns 0 if more frags are required
+   or if the packet was dropped. */
+
+FD_FN_UNUSED static ulong
+fd_net_rx_gather_commit( fd_net_rx_gather_t * gather,
+                         ulong                seq,
+                         ulong                ctl ) {
+  ulong frag_sz   = gather->frag_sz;
+  gather->frag_sz = ULONG_MAX;
+  if( FD_UNLIKELY( frag_sz==ULONG_MAX ) ) {
+    gather->active = 0;
+    return 0UL;
+  }
+  if( !( ctl & FD_NET_RX_CTL_CONT ) ) gather->sz = 0UL;
+  gather->sz += frag_sz;
+  if( ctl & FD_NET_RX_CTL_MORE ) {
+    gather->active = 1;
+    gather->seq    = fd_seq_inc( seq, 1UL );
+    return 0UL;
+  }
+  gather->active = 0;
+  return gather->sz;
+}
+
+FD_PROTOTYPES_END
+
+/* Topology APIs */
+
+FD_PROTOTYPES_BEGIN
+
+/* fd_topos_net_tiles appends the net and netlnk tiles to the
+   topology.  These tiles provide fast XDP networking. */
+
+/* FIXME layering violation */
+struct fd_config_net;
+typedef struct fd_config_net fd_config_net_t;
+
+void
+fd_topos_net_tiles( fd_topo_t *             topo,
+                    ulong                   net_tile_cnt,
+                    fd_config_net_t const * net_config,
+                    ulong                   netlnk_max_routes,
+                    ulong                   netlnk_max_peer_routes,
+                    ulong                   netlnk_max_neighbors,
+                    ulong const             tile_to_cpu[ FD_TILE_MAX ] );
+
+/* fd_topos_net_rx_link is like fd_topob_link, but for net->app tile
+   packet RX links. */
+
+void
+fd_topos_net_rx_link( fd_topo_t *  topo,
+                      char const * link_name,
+                      ulong        net_kind_id,
+                      ulong        depth );
+
+/* fd_topob_tile_in_net registers a net TX link with all net tiles. */
+
+void
+fd_topos_tile_in_net( fd_topo_t *  topo,
+                      char const * fseq_wksp,
+                      char const * link_name,
+                      ulong        link_kind_id,
+                      int          reliable,
+                      int          polled );
+
+/* This should be called *after* all app<->net tile links have been
+   created.  Should be called once per net tile. */
+
+void
+fd_topos_net_tile_finish( fd_topo_t * topo,
+                          ulong       net_kind_id );
+
+FD_PROTOTYPES_END
+
+#endif /* HEADER_fd_src_disco_net_fd_net_tile_h */
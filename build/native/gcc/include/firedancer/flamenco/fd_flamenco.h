@@ -0,0 +1,6 @@
+#ifndef HEADER_fd_src_flamenco_fd_flamenco_h
+#define HEADER_fd_src_flamenco_fd_flamenco_h
+
+#include "fd_flamenco_base.h"
+
+#endif /* HEADER_fd_src_flamenco_fd_flamenco_h */
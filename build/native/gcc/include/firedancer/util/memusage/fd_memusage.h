@@ -0,0 +1,8 @@
+#ifndef HEADER_fd_src_util_memusage_fd_memusage_h
+#define HEADER_fd_src_util_memusage_fd_memusage_h
+
+#include "../fd_util.h"
+
+void fd_memusage_printout( char const * filename );
+
+#endif /* HEADER_fd_src_util_memusage_fd_memusage_h */
@@ -0,0 +1,156 @@
+#ifndef HEADER_fd_src_waltz_quic_fd_quic_conn_id_h
+#define HEADER_fd_src_waltz_quic_fd_quic_conn_id_h
+
+#include "../../util/fd_util_base.h"
+#include "../../util/rng/fd_rng.h"
+#include <string.h>
+
+/* TODO move this into more reasonable place */
+#define FD_QUIC_MAX_CONN_ID_SZ 20
+
+/* Firedancer connection ids will sized thus */
+#define FD_QUIC_CONN_ID_SZ 8
+
+/* pad fd_quic_conn_id struct */
+#define FD_QUIC_CONN_ID_PAD (24 - 1 - FD_QUIC_MAX_CONN_ID_SZ)
+
+/* fd_quic_conn_id_t contains a QUIC connection ID with size in [0,20]
+   bytes.  The unused conn_id high bytes MUST be zeroed. */
+
+struct fd_quic_conn_id {
+  uchar sz;
+  uchar conn_id[FD_QUIC_MAX_CONN_ID_SZ];
+
+  /* explicitly pad for alignment */
+  uchar pad[FD_QUIC_CONN_ID_PAD];
+};
+typedef struct fd_quic_conn_id fd_quic_conn_id_t;
+
+FD_PROTOTYPES_BEGIN
+
+static inline fd_quic_conn_id_t
+fd_quic_conn_id_new( void const * conn_id,
+                     ulong        sz /* in [0,20] */ ) {
+  /* TODO debug assertion verifying sz */
+  fd_quic_conn_id_t id = { .sz = (uchar)sz };
+  fd_memcpy( id.conn_id, conn_id, sz );
+  return id;
+}
+
+/* fd_quic_conn_id_rand creates a new random 8 byte conn ID.  Returns
+   conn ID.  Cannot fail. */
+
+static inline fd_quic_conn_id_t *
+fd_quic_conn_id_rand( fd_quic_conn_id_t * conn_id,
+                      fd_rng_t *          rng ) {
+
+  /* from rfc9000:
+     Each endpoint selects connection IDs using an implementation-specific (and
+       perhaps deployment-specific) method that will allow packets with that
+       connection ID to be routed back to the endpoint and to be identified by
+       the endpoint upon receipt. */
+  /* this means we can generate a connection id with the property that it can
+     be delivered to the same endpoint by flow control */
+  /* See fd_quic_conn_id_rand_shard for flow steering */
+
+  /* padding must be set to zero also */
+  *conn_id = (fd_quic_conn_id_t){ .sz = 8u, .conn_id = {0u}, .pad = {0u} };
+  FD_STORE( ulong, conn_id->conn_id, fd_rng_ulong( rng ) );
+  return conn_id;
+}
+
+/* Connection ID sharding *********************************************
+
+   A host may run multiple fd_quic instances behind the same UDP port
+   (e.g. one per quic tile).  Each instance is assigned a shard index,
+   which is stored in the first byte of every conn ID that instance
+   chooses for itself.  The remaining 7 bytes are random.  This allows
+   steering a packet to the instance owning its connection by looking
+   at the packet's DCID alone.  Unlike the 4-tuple, the DCID does not
+   change when the peer's address changes (NAT rebinding, migration),
+   nor does it collapse all conns of a busy peer onto one instance.
+
+   The first Initial packets of a conn carry a DCID chosen by the
+   client.  Its first byte is random, so steering new conns by that
+   byte spreads them evenly across instances.  The instance that
+   receives them replies with a SCID (or a Retry SCID) carrying its own
+   shard index, so that all later packets of the conn are steered back
+   to it. */
+
+#define FD_QUIC_CONN_ID_SHARD_MAX (256UL)
+
+/* fd_quic_conn_id_shard returns the shard index of an 8 byte conn ID
+   chosen by fd_quic_conn_id_rand_shard.  (The conn ID is the host
+   representation of the first FD_QUIC_CONN_ID_SZ bytes on the wire.) */
+
+FD_FN_CONST static inline ulong
+fd_quic_conn_id_shard( ulong conn_id ) {
+  return conn_id & 0xffUL;
+}
+
+/* fd_quic_conn_id_rand_shard returns a new random 8 byte conn ID owned
+   by the given shard in [0,FD_QUIC_CONN_ID_SHARD_MAX). */
+
+static inline ulong
+fd_quic_conn_id_rand_shard( fd_rng_t * rng,
+                            ulong      shard ) {
+  return ( fd_rng_ulong( rng ) & ~0xffUL ) | ( shard & 0xffUL );
+}
+
+/* fd_quic_pkt_shard returns the shard key of the QUIC packet at
+   [pkt,pkt+pkt_sz) (i.e. the UDP payload) without decrypting it.  This
+   is the first byte of the packet's DCID.  For packets addressed to an
+   fd_quic instance, this is the owning shard index, and for new conns
+   it is a random byte chosen by the client.  A load balancer should
+   deliver packets with key k to instance (k % instance_cnt), which is
+   instance k if the shard indices are [0,instance_cnt).
+
+   Short header packets are assumed to carry a FD_QUIC_CONN_ID_SZ byte
+   DCID, since the length is not on the wire.  Returns ULONG_MAX if the
+   packet is too short or has a zero length DCID.  The caller should
+   fall back to another steering method in that case. */
+
+FD_FN_PURE static inline ulong
+fd_quic_pkt_shard( uchar const * pkt,
+                   ulong         pkt_sz ) {
+  if( FD_UNLIKELY( !pkt_sz ) ) return ULONG_MAX;
+  if( pkt[0] & 0x80 ) {
+    /* long header: flags (1), version (4), DCID len (1), DCID */
+    if( FD_UNLIKELY( pkt_sz<7UL || !pkt[5] ) ) return ULONG_MAX;
+    return pkt[6];
+  } else {
+    /* short header: flags (1), DCID */
+    if( FD_UNLIKELY( pkt_sz<1UL+FD_QUIC_CONN_ID_SZ ) ) return ULONG_MAX;
+    return pkt[1];
+  }
+}
+
+FD_PROTOTYPES_END
+
+/* Defines a NULL connection id
+   Used as a NULL key in hash maps
+   Note that the QUIC protocol supports zero-length connection ids.
+   Hence, an all-zero fd_quic_conn_id_t wouldn't work as a NULL key */
+#define FD_QUIC_CONN_ID_NULL ((fd_quic_conn_id_t){ .sz = 0xff })
+
+/* define some functions for using fd_quic_conn_id as a key */
+
+/* is this an invalid connection id */
+#define FD_QUIC_CONN_ID_INVAL(CONN_ID) ((CONN_ID).sz > FD_QUIC_MAX_CONN_ID_SZ)
+
+/* are these connection ids the same connection id
+   for this to work properly, all unused bytes are set to zero */
+#define FD_QUIC_CONN_ID_EQUAL(LHS,RHS) \
+  (memcmp(&(LHS),&(RHS),sizeof(fd_quic_conn_id_t))==0)
+
+/* fd_quic_net_endpoint_t identifies a UDP/IP network endpoint.
+    May change during the lifetime of the conn. */
+
+struct fd_quic_net_endpoint {
+  uint   ip_addr;  /* net */
+  ushort udp_port; /* host */
+};
+typedef struct fd_quic_net_endpoint fd_quic_net_endpoint_t;
+
+#endif /* HEADER_fd_src_waltz_quic_fd_quic_conn_id_h */
+
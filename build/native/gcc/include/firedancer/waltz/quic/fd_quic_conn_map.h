@@ -0,0 +1,27 @@
+#ifndef HEADER_fd_src_waltz_quic_fd_quic_conn_map_h
+#define HEADER_fd_src_waltz_quic_fd_quic_conn_map_h
+
+#include "fd_quic_common.h"
+
+struct __attribute__((aligned(16))) fd_quic_conn_map {
+  ulong conn_id;
+  fd_quic_conn_t * conn;
+};
+typedef struct fd_quic_conn_map fd_quic_conn_map_t;
+
+/* Conn IDs are random, except for the low byte, which is the same
+   shard index for every conn of this fd_quic instance (see
+   fd_quic_conn_id_rand_shard).  The hash skips that byte, otherwise all
+   conns would start probing at the same few slots.  The key is never
+   derived from the peer's address, so lookups still find the conn
+   after the peer migrated. */
+
+#define MAP_NAME        fd_quic_conn_map
+#define MAP_T           fd_quic_conn_map_t
+#define MAP_KEY         conn_id
+#define MAP_MEMOIZE     0
+#define MAP_KEY_HASH(k) ((uint)((k)>>8))
+#include "../../util/tmpl/fd_map_dynamic.c"
+
+#endif /* HEADER_fd_src_waltz_quic_fd_quic_conn_map_h */
+
@@ -0,0 +1,43 @@
+/* defaults to simplify templates */
+
+#ifndef FD_TEMPL_DEF_STRUCT_BEGIN
+#  define FD_TEMPL_DEF_STRUCT_BEGIN(...)
+#endif
+
+#ifndef FD_TEMPL_MBR_ELEM
+#  define FD_TEMPL_MBR_ELEM(...)
+#endif
+
+#ifndef FD_TEMPL_MBR_ELEM_VARINT
+#  define FD_TEMPL_MBR_ELEM_VARINT(...)
+#endif
+
+#ifndef FD_TEMPL_MBR_ELEM_PKTNUM
+#  define FD_TEMPL_MBR_ELEM_PKTNUM(...)
+#endif
+
+#ifndef FD_TEMPL_MBR_ELEM_VAR
+#  define FD_TEMPL_MBR_ELEM_VAR(...)
+#endif
+
+#ifndef FD_TEMPL_MBR_ELEM_VAR_RAW
+#  define FD_TEMPL_MBR_ELEM_VAR_RAW(...)
+#endif
+
+#ifndef FD_TEMPL_MBR_ELEM_RAW
+#  define FD_TEMPL_MBR_ELEM_RAW(...)
+#endif
+
+#ifndef FD_TEMPL_MBR_FRAME_TYPE
+#  define FD_TEMPL_MBR_FRAME_TYPE(...)
+#endif
+
+#ifndef FD_TEMPL_MBR_ELEM_HIDDEN
+#  define FD_TEMPL_MBR_ELEM_HIDDEN(...)
+#endif
+
+#ifndef FD_TEMPL_DEF_STRUCT_END
+#  define FD_TEMPL_DEF_STRUCT_END(...)
+#endif
+
+